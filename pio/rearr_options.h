@@ -5,6 +5,7 @@
 #define COLLECTIVE 0
 #define POINT_TO_POINT 1
 #define FLOW_CONTROL 2
+#define NEIGHBOR 3
 
 ! Default values for POINT_TO_POINT and FLOW_CONTROL
 #define DEF_P2P_HANDSHAKE .true.
@@ -1,3 +1,6 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE   /* sched_getcpu */
+#endif
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -477,3 +480,167 @@ int bgq_pset_info (MPI_Fint comm2, int* tot_pset, int* psetID, int* pset_size, i
 }
 
 #endif
+
+#if !defined(BGL) && !defined(BGP) && !defined(BGQ) && !defined(_MPISERIAL)
+
+#include <mpi.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+/* Socket of the core this task is running on, -1 if unknown.  Only
+   meaningful when the tasks are bound to their cores. */
+static int cpu_socket(void)
+{
+  int socket = -1;
+#if defined(__linux__) && defined(_GNU_SOURCE)
+  char path[80];
+  FILE *f;
+  int cpu = sched_getcpu();
+
+  if(cpu < 0) return -1;
+  snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+  f = fopen(path, "r");
+  if(f == NULL) return -1;
+  if(fscanf(f, "%d", &socket) != 1) socket = -1;
+  fclose(f);
+#endif
+  return socket;
+}
+
+/* Split comm into one communicator per shared memory node.  Without
+   MPI-3 the nodes are told apart by their processor names. */
+static void split_node(MPI_Comm comm, MPI_Comm *node_comm)
+{
+  int rank;
+
+  MPI_Comm_rank(comm, &rank);
+#ifndef NO_MPI3
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, node_comm);
+#else
+  {
+    char name[MPI_MAX_PROCESSOR_NAME];
+    char *names;
+    int size, color, len;
+
+    MPI_Comm_size(comm, &size);
+    names = malloc((size_t)size*MPI_MAX_PROCESSOR_NAME);
+    memset(name, 0, sizeof(name));
+    MPI_Get_processor_name(name, &len);
+    MPI_Allgather(name, MPI_MAX_PROCESSOR_NAME, MPI_CHAR,
+		  names, MPI_MAX_PROCESSOR_NAME, MPI_CHAR, comm);
+    /* the first task with the same name names the node */
+    for(color=0; color<rank; color++)
+      if(strncmp(names+(size_t)color*MPI_MAX_PROCESSOR_NAME, name, MPI_MAX_PROCESSOR_NAME) == 0) break;
+    free(names);
+    MPI_Comm_split(comm, color, rank, node_comm);
+  }
+#endif
+}
+
+/* The number of shared memory nodes of comm and the most tasks on one. */
+void pio_nodecount(MPI_Fint *comm, int *nnodes, int *maxnodesize)
+{
+  MPI_Comm comm2, node_comm;
+  int node_rank, node_size, leader;
+
+  comm2 = MPI_Comm_f2c(*comm);
+  split_node(comm2, &node_comm);
+  MPI_Comm_rank(node_comm, &node_rank);
+  MPI_Comm_size(node_comm, &node_size);
+  MPI_Comm_free(&node_comm);
+
+  leader = (node_rank == 0);
+  MPI_Allreduce(&leader, nnodes, 1, MPI_INT, MPI_SUM, comm2);
+  MPI_Allreduce(&node_size, maxnodesize, 1, MPI_INT, MPI_MAX, comm2);
+}
+
+/*
+     Spread numiotasks io tasks evenly over the nodes of comm.
+
+     The nodes are numbered by their lowest rank in comm, and the first
+     numiotasks % nnodes nodes take one io task more than the others.  A
+     node never has more io tasks than tasks, so numiotasks is set to the
+     number actually placed; numiotasks <= 0 asks for one per node.
+
+     Within a node the io tasks are spread evenly over the candidate
+     tasks, in rank order.  The candidates are the tasks of rank >= base
+     running on the given socket, or on any socket when socket < 0; if a
+     node has too few of them the socket and then the base are dropped.
+
+     Collective over comm, iamIOtask is set to 1 on the io tasks.
+*/
+void pio_nodeiotasks(MPI_Fint *comm, int *numiotasks, int *base, int *socket, int *iamIOtask)
+{
+  static const int tiers[3] = {3, 1, 0};
+  MPI_Comm comm2, node_comm;
+  int rank, node_rank, node_size, leader, nnodes, node_id, nio;
+  int flag, t, ncand, j;
+  int *flags, *cand;
+
+  comm2 = MPI_Comm_f2c(*comm);
+  MPI_Comm_rank(comm2, &rank);
+
+  split_node(comm2, &node_comm);
+  MPI_Comm_rank(node_comm, &node_rank);
+  MPI_Comm_size(node_comm, &node_size);
+
+  /* number the nodes by counting the leaders below each leader */
+  leader = (node_rank == 0);
+  node_id = 0;
+  MPI_Exscan(&leader, &node_id, 1, MPI_INT, MPI_SUM, comm2);
+  if(rank == 0) node_id = 0;
+  MPI_Bcast(&node_id, 1, MPI_INT, 0, node_comm);
+  MPI_Allreduce(&leader, &nnodes, 1, MPI_INT, MPI_SUM, comm2);
+
+  if((*numiotasks) <= 0) {
+    nio = 1;
+  } else {
+    nio = (*numiotasks)/nnodes + (node_id < (*numiotasks)%nnodes ? 1 : 0);
+  }
+  if(nio > node_size) nio = node_size;
+
+  /* bit 0: rank >= base, bit 1: on the requested socket */
+  flag = 0;
+  if(rank >= (*base)) flag |= 1;
+  if((*socket) < 0 || cpu_socket() == (*socket)) flag |= 2;
+  flags = malloc(node_size*sizeof(int));
+  cand = malloc(node_size*sizeof(int));
+  MPI_Allgather(&flag, 1, MPI_INT, flags, 1, MPI_INT, node_comm);
+
+  ncand = 0;
+  for(t=0; t<3 && ncand<nio; t++) {
+    ncand = 0;
+    for(j=0; j<node_size; j++)
+      if((flags[j] & tiers[t]) == tiers[t]) cand[ncand++] = j;
+  }
+
+  (*iamIOtask) = 0;
+  for(j=0; j<nio; j++) {
+    if(cand[(j*ncand)/nio] == node_rank) (*iamIOtask) = 1;
+  }
+  free(flags);
+  free(cand);
+  MPI_Comm_free(&node_comm);
+
+  MPI_Allreduce(iamIOtask, numiotasks, 1, MPI_INT, MPI_SUM, comm2);
+}
+
+#endif
+
+#ifdef HAVE_SLASHPROC
+#include <unistd.h>
+#endif
+
+/* Bytes in the unit of the rss returned by GPTLget_memusage, which the
+   timing library builds with the same definitions as pio */
+int pio_memusage_unit(void)
+{
+#if defined(BGP)
+  return 1;                             /* mallinfo, bytes */
+#elif defined(HAVE_SLASHPROC)
+  return (int) sysconf(_SC_PAGESIZE);   /* /proc/<pid>/statm, pages */
+#else
+  return 1024;                          /* ps on macOS, getrusage elsewhere: KB */
+#endif
+}
@@ -187,11 +187,11 @@ my \$confopts = {all=>" --enable-pnetcdf --enable-mpiio --enable-netcdf --enable
                 vdc=>"--enable-compression --enable-pnetcdf --disable-netcdf --enable-timing"};
 
 my \$testlist = {all=>["sn01","sn02","sn03","sb01","sb02","sb03","sb04","sb05","sb06","sb07","sb08",
-                      "pn01","pn02","pn03","pb01","pb02","pb03","pb04","pb05","pb06","pb07","pb08",
+                      "pn01","pn02","pn03","pb01","pb02","pb03","pb04","pb05","pb06","pb07","pb08","pb09","pb10","pb11",
                       "bn01","bn02","bn03","bb01","bb02","bb03","bb04","bb05","bb06","bb07","bb08",
                       "wr01","rd01","apb05","asb01","asb04"],
 		snet=>["sn01","sn02","sn03","sb01","sb02","sb03","sb04","sb05","sb06","sb07","sb08","asb01","asb04" ],
-		pnet=>["pn01","pn02","pn03","pb01","pb02","pb03","pb04","pb05","pb06","pb07","pb08","apb05"],
+		pnet=>["pn01","pn02","pn03","pb01","pb02","pb03","pb04","pb05","pb06","pb07","pb08","pb09","pb10","pb11","apb05"],
 		ant=>["sn02","sb02","pn02","pb02","bn02","bb02"],
 		mpiio=>["bn01","bn02","bn03","bb01","bb02","bb03","bb04","bb05","bb06","bb07","bb08"]};
 